@@ -30,14 +30,87 @@ typedef struct {
     CrosshairStyle style;
     double offset_x;
     double offset_y;
+    gboolean visible;
 } CrosshairConfig;
 
+typedef enum {
+    PASS_OUTLINE = 0,
+    PASS_FILL
+} CrosshairPass;
+
+typedef enum {
+    CFG_CHANGED_NONE     = 0,
+    CFG_CHANGED_OFFSET   = 1 << 0,
+    CFG_CHANGED_COLOR    = 1 << 1,
+    CFG_CHANGED_GEOMETRY = 1 << 2,
+    CFG_CHANGED_VISIBILITY = 1 << 3,
+    CFG_CHANGED_ALL      = CFG_CHANGED_OFFSET | CFG_CHANGED_COLOR | CFG_CHANGED_GEOMETRY | CFG_CHANGED_VISIBILITY
+} ConfigChange;
+
+// Everything a raster depends on. Only the geometry fields of cfg count:
+// colors are applied when the masks are composited, the integer part of the
+// crosshair position only moves the blit and the sub-pixel part is baked in.
+typedef struct {
+    CrosshairConfig cfg;
+    double frac_x, frac_y;
+    int scale;
+} RasterKey;
+
+// Immutable once produced by the worker. Both A8 masks are centered on the
+// crosshair and span 2 * half logical pixels; outline is NULL when disabled.
 typedef struct {
+    RasterKey key;
+    cairo_surface_t *fill;
+    cairo_surface_t *outline;
+    int half;
+} CrosshairRaster;
+
+typedef struct {
+    guint layer_id;
+    RasterKey key;
+} RasterJob;
+
+// Last composited frame persisted under $XDG_CACHE_HOME, shown at login before
+// the config is parsed or the preferences are built.
+typedef struct {
+    cairo_surface_t *surface;
+    int x, y;
+    int width, height;
+} FrameSnapshot;
+
+typedef struct AppState AppState;
+
+// One entry of the crosshair stack. Each layer draws into its own drawing
+// area, sized to its raster and placed in a GtkFixed, so GTK keeps the render
+// nodes of untouched layers and a moved layer is not redrawn at all.
+typedef struct {
+    AppState *st;
+    guint id;
+    CrosshairConfig cfg;
+    GtkDrawingArea *area;
+
+    CrosshairRaster *raster;
+    RasterKey pending_key;
+    gboolean raster_pending;
+    GCancellable *raster_cancel;
+    guint raster_serial;
+
+    guint blit_serial;
+    CrosshairConfig blit_cfg;
+    int blit_x, blit_y;
+} CrosshairLayer;
+
+struct AppState {
     AdwApplication *app;
     GtkWindow *overlay;
+    GtkOverlay *layer_stack;
+    GtkFixed *layer_fixed;
     GtkDrawingArea *drawing_area;
 
     AdwPreferencesWindow *prefs;
+    GtkDropDown *layer_dropdown;
+    GtkSwitch *visible_switch;
+    GtkButton *remove_layer_button;
     GtkDropDown *style_dropdown;
     GtkScale *thickness_scale;
     GtkScale *size_scale;
@@ -56,15 +129,61 @@ typedef struct {
     GtkSpinButton *posy_spin;
 
     GPtrArray *monitors;
-    CrosshairConfig cfg;
+    GPtrArray *layers;
+    guint active_layer;
+    guint next_layer_id;
+
+    FrameSnapshot *snapshot;
+    char *config_hash;
+    gboolean startup_pending;
+    guint finish_startup_id;
+    gboolean first_frame_logged;
+    gboolean first_frame_cached;
+    gulong first_frame_handler;
+    GdkFrameClock *first_frame_clock;
+    gint64 first_frame_counter;
+    gint64 first_frame_commit;
+    guint first_frame_polls;
+    guint snapshot_save_id;
+    GCancellable *snapshot_cancel;
+    int area_width, area_height;
+
+    GFileMonitor *config_monitor;
+    guint reload_id;
+    gboolean syncing_widgets;
+
     gboolean overlay_visible;
     gboolean using_layer_shell;
-} AppState;
+};
+
+static gint64 hc_start_time;
+
+static CrosshairLayer* active_layer(AppState *st) {
+    if (!st->layers || st->active_layer >= st->layers->len) return NULL;
+    return g_ptr_array_index(st->layers, st->active_layer);
+}
+
+static CrosshairLayer* find_layer(AppState *st, guint id) {
+    for (guint i = 0; st->layers && i < st->layers->len; i++) {
+        CrosshairLayer *layer = g_ptr_array_index(st->layers, i);
+        if (layer->id == id) return layer;
+    }
+    return NULL;
+}
+
+static void queue_layer_redraw(CrosshairLayer *layer) {
+    if (layer && layer->area) {
+        gtk_widget_queue_draw(GTK_WIDGET(layer->area));
+    }
+}
 
 static void queue_redraw(AppState *st) {
-    if (st && st->drawing_area) {
+    if (!st) return;
+    if (st->drawing_area) {
         gtk_widget_queue_draw(GTK_WIDGET(st->drawing_area));
     }
+    for (guint i = 0; st->layers && i < st->layers->len; i++)
+        queue_layer_redraw(g_ptr_array_index(st->layers, i));
 }
 
 static char* hc_get_config_path(void) {
@@ -76,38 +195,108 @@ static char* hc_get_config_path(void) {
     return path;
 }
 
-static void save_config(AppState *st) {
-    if (!st) return;
-    GKeyFile *kf = g_key_file_new();
-    const char *grp = "Crosshair";
-    g_key_file_set_double(kf, grp, "r", st->cfg.r);
-    g_key_file_set_double(kf, grp, "g", st->cfg.g);
-    g_key_file_set_double(kf, grp, "b", st->cfg.b);
-    g_key_file_set_double(kf, grp, "a", st->cfg.a);
+static char* hc_get_cache_dir(void) {
+    char *dir = g_build_filename(g_get_user_cache_dir(), "hyprcrosshair", NULL);
+    g_mkdir_with_parents(dir, 0700);
+    return dir;
+}
 
-    g_key_file_set_double(kf, grp, "thickness", st->cfg.thickness);
-    g_key_file_set_double(kf, grp, "size", st->cfg.size);
-    g_key_file_set_double(kf, grp, "gap", st->cfg.gap);
+static char* hc_config_checksum(const char *data, gsize len) {
+    return g_compute_checksum_for_data(G_CHECKSUM_SHA256, (const guchar *)(data ? data : ""), len);
+}
 
-    g_key_file_set_boolean(kf, grp, "show_outline", st->cfg.show_outline);
-    g_key_file_set_double(kf, grp, "outline_thickness", st->cfg.outline_thickness);
-    g_key_file_set_double(kf, grp, "or", st->cfg.or);
-    g_key_file_set_double(kf, grp, "og", st->cfg.og);
-    g_key_file_set_double(kf, grp, "ob", st->cfg.ob);
-    g_key_file_set_double(kf, grp, "oa", st->cfg.oa);
-    g_key_file_set_double(kf, grp, "outline_opacity", st->cfg.outline_opacity);
+static char* hc_read_config_hash(void) {
+    char *path = hc_get_config_path();
+    char *data = NULL;
+    gsize len = 0;
+    if (!g_file_get_contents(path, &data, &len, NULL)) {
+        data = NULL;
+        len = 0;
+    }
+    char *hash = hc_config_checksum(data, len);
+    g_free(data);
+    g_free(path);
+    return hash;
+}
 
-    g_key_file_set_integer(kf, grp, "style", (int)st->cfg.style);
+static char* hc_monitor_signature(GdkMonitor *mon) {
+    GdkRectangle geo = {0};
+    gdk_monitor_get_geometry(mon, &geo);
+    const char *conn = gdk_monitor_get_connector(mon);
+    return g_strdup_printf("%s %dx%d@%d", conn ? conn : "", geo.width, geo.height,
+                           gdk_monitor_get_scale_factor(mon));
+}
 
-    g_key_file_set_double(kf, grp, "offset_x", st->cfg.offset_x);
-    g_key_file_set_double(kf, grp, "offset_y", st->cfg.offset_y);
+static void crosshair_config_defaults(CrosshairConfig *c) {
+    c->r = 0.15; c->g = 0.85; c->b = 0.35; c->a = 0.95;
+    c->thickness = 2.0;
+    c->size = 40.0;
+    c->gap = 8.0;
+    c->style = STYLE_CROSS_DOT;
+
+    c->show_outline = TRUE;
+    c->outline_thickness = 1.5;
+    c->or = 0.0; c->og = 0.0; c->ob = 0.0; c->oa = 0.9;
+    c->outline_opacity = 1.0;
+
+    c->offset_x = 0.0;
+    c->offset_y = 0.0;
+    c->visible = TRUE;
+}
+
+static char* layer_group_name(guint index) {
+    return index == 0 ? g_strdup("Crosshair") : g_strdup_printf("Layer %u", index);
+}
+
+static void config_to_keyfile(GKeyFile *kf, const char *grp, const CrosshairConfig *c) {
+    g_key_file_set_double(kf, grp, "r", c->r);
+    g_key_file_set_double(kf, grp, "g", c->g);
+    g_key_file_set_double(kf, grp, "b", c->b);
+    g_key_file_set_double(kf, grp, "a", c->a);
+
+    g_key_file_set_double(kf, grp, "thickness", c->thickness);
+    g_key_file_set_double(kf, grp, "size", c->size);
+    g_key_file_set_double(kf, grp, "gap", c->gap);
+
+    g_key_file_set_boolean(kf, grp, "show_outline", c->show_outline);
+    g_key_file_set_double(kf, grp, "outline_thickness", c->outline_thickness);
+    g_key_file_set_double(kf, grp, "or", c->or);
+    g_key_file_set_double(kf, grp, "og", c->og);
+    g_key_file_set_double(kf, grp, "ob", c->ob);
+    g_key_file_set_double(kf, grp, "oa", c->oa);
+    g_key_file_set_double(kf, grp, "outline_opacity", c->outline_opacity);
+
+    g_key_file_set_integer(kf, grp, "style", (int)c->style);
+
+    g_key_file_set_double(kf, grp, "offset_x", c->offset_x);
+    g_key_file_set_double(kf, grp, "offset_y", c->offset_y);
+
+    g_key_file_set_boolean(kf, grp, "visible", c->visible);
+}
+
+static void schedule_snapshot_save(AppState *st);
+
+static void save_config(AppState *st) {
+    if (!st || !st->layers) return;
+    GKeyFile *kf = g_key_file_new();
+    for (guint i = 0; i < st->layers->len; i++) {
+        CrosshairLayer *layer = g_ptr_array_index(st->layers, i);
+        char *grp = layer_group_name(i);
+        config_to_keyfile(kf, grp, &layer->cfg);
+        g_free(grp);
+    }
 
     gsize len = 0;
     GError *err = NULL;
     char *data = g_key_file_to_data(kf, &len, &err);
     if (data && len > 0) {
         char *path = hc_get_config_path();
-        g_file_set_contents(path, data, len, NULL);
+        if (g_file_set_contents(path, data, len, NULL)) {
+            g_free(st->config_hash);
+            st->config_hash = hc_config_checksum(data, len);
+            // The cached frame is keyed by this hash, even if nothing on screen moved.
+            schedule_snapshot_save(st);
+        }
         g_free(path);
     }
     g_clear_error(&err);
@@ -115,51 +304,188 @@ static void save_config(AppState *st) {
     g_key_file_unref(kf);
 }
 
-static void load_config(AppState *st) {
-    if (!st) return;
-    char *path = hc_get_config_path();
-    if (!g_file_test(path, G_FILE_TEST_EXISTS)) {
-        g_free(path);
-        return;
-    }
-    GKeyFile *kf = g_key_file_new();
-    GError *err = NULL;
-    if (!g_key_file_load_from_file(kf, path, G_KEY_FILE_NONE, &err)) {
-        g_clear_error(&err);
-        g_key_file_unref(kf);
-        g_free(path);
-        return;
-    }
-    const char *grp = "Crosshair";
-    if (g_key_file_has_key(kf, grp, "r", NULL)) st->cfg.r = g_key_file_get_double(kf, grp, "r", NULL);
-    if (g_key_file_has_key(kf, grp, "g", NULL)) st->cfg.g = g_key_file_get_double(kf, grp, "g", NULL);
-    if (g_key_file_has_key(kf, grp, "b", NULL)) st->cfg.b = g_key_file_get_double(kf, grp, "b", NULL);
-    if (g_key_file_has_key(kf, grp, "a", NULL)) st->cfg.a = g_key_file_get_double(kf, grp, "a", NULL);
+static void config_from_keyfile(GKeyFile *kf, const char *grp, CrosshairConfig *c) {
+    if (g_key_file_has_key(kf, grp, "r", NULL)) c->r = g_key_file_get_double(kf, grp, "r", NULL);
+    if (g_key_file_has_key(kf, grp, "g", NULL)) c->g = g_key_file_get_double(kf, grp, "g", NULL);
+    if (g_key_file_has_key(kf, grp, "b", NULL)) c->b = g_key_file_get_double(kf, grp, "b", NULL);
+    if (g_key_file_has_key(kf, grp, "a", NULL)) c->a = g_key_file_get_double(kf, grp, "a", NULL);
 
-    if (g_key_file_has_key(kf, grp, "thickness", NULL)) st->cfg.thickness = g_key_file_get_double(kf, grp, "thickness", NULL);
-    if (g_key_file_has_key(kf, grp, "size", NULL)) st->cfg.size = g_key_file_get_double(kf, grp, "size", NULL);
-    if (g_key_file_has_key(kf, grp, "gap", NULL)) st->cfg.gap = g_key_file_get_double(kf, grp, "gap", NULL);
+    if (g_key_file_has_key(kf, grp, "thickness", NULL)) c->thickness = g_key_file_get_double(kf, grp, "thickness", NULL);
+    if (g_key_file_has_key(kf, grp, "size", NULL)) c->size = g_key_file_get_double(kf, grp, "size", NULL);
+    if (g_key_file_has_key(kf, grp, "gap", NULL)) c->gap = g_key_file_get_double(kf, grp, "gap", NULL);
 
-    if (g_key_file_has_key(kf, grp, "show_outline", NULL)) st->cfg.show_outline = g_key_file_get_boolean(kf, grp, "show_outline", NULL);
-    if (g_key_file_has_key(kf, grp, "outline_thickness", NULL)) st->cfg.outline_thickness = g_key_file_get_double(kf, grp, "outline_thickness", NULL);
-    if (g_key_file_has_key(kf, grp, "or", NULL)) st->cfg.or = g_key_file_get_double(kf, grp, "or", NULL);
-    if (g_key_file_has_key(kf, grp, "og", NULL)) st->cfg.og = g_key_file_get_double(kf, grp, "og", NULL);
-    if (g_key_file_has_key(kf, grp, "ob", NULL)) st->cfg.ob = g_key_file_get_double(kf, grp, "ob", NULL);
-    if (g_key_file_has_key(kf, grp, "oa", NULL)) st->cfg.oa = g_key_file_get_double(kf, grp, "oa", NULL);
-    if (g_key_file_has_key(kf, grp, "outline_opacity", NULL)) st->cfg.outline_opacity = g_key_file_get_double(kf, grp, "outline_opacity", NULL);
+    if (g_key_file_has_key(kf, grp, "show_outline", NULL)) c->show_outline = g_key_file_get_boolean(kf, grp, "show_outline", NULL);
+    if (g_key_file_has_key(kf, grp, "outline_thickness", NULL)) c->outline_thickness = g_key_file_get_double(kf, grp, "outline_thickness", NULL);
+    if (g_key_file_has_key(kf, grp, "or", NULL)) c->or = g_key_file_get_double(kf, grp, "or", NULL);
+    if (g_key_file_has_key(kf, grp, "og", NULL)) c->og = g_key_file_get_double(kf, grp, "og", NULL);
+    if (g_key_file_has_key(kf, grp, "ob", NULL)) c->ob = g_key_file_get_double(kf, grp, "ob", NULL);
+    if (g_key_file_has_key(kf, grp, "oa", NULL)) c->oa = g_key_file_get_double(kf, grp, "oa", NULL);
+    if (g_key_file_has_key(kf, grp, "outline_opacity", NULL)) c->outline_opacity = g_key_file_get_double(kf, grp, "outline_opacity", NULL);
 
     if (g_key_file_has_key(kf, grp, "style", NULL)) {
         int s = g_key_file_get_integer(kf, grp, "style", NULL);
         if (s < 0) s = 0;
         if (s >= (int)STYLE_COUNT) s = (int)STYLE_CROSS;
-        st->cfg.style = (CrosshairStyle)s;
+        c->style = (CrosshairStyle)s;
     }
 
-    if (g_key_file_has_key(kf, grp, "offset_x", NULL)) st->cfg.offset_x = g_key_file_get_double(kf, grp, "offset_x", NULL);
-    if (g_key_file_has_key(kf, grp, "offset_y", NULL)) st->cfg.offset_y = g_key_file_get_double(kf, grp, "offset_y", NULL);
+    if (g_key_file_has_key(kf, grp, "offset_x", NULL)) c->offset_x = g_key_file_get_double(kf, grp, "offset_x", NULL);
+    if (g_key_file_has_key(kf, grp, "offset_y", NULL)) c->offset_y = g_key_file_get_double(kf, grp, "offset_y", NULL);
+
+    if (g_key_file_has_key(kf, grp, "visible", NULL)) c->visible = g_key_file_get_boolean(kf, grp, "visible", NULL);
+}
+
+static GArray* default_layer_configs(void) {
+    GArray *cfgs = g_array_new(FALSE, FALSE, sizeof(CrosshairConfig));
+    CrosshairConfig c;
+    crosshair_config_defaults(&c);
+    g_array_append_val(cfgs, c);
+    return cfgs;
+}
+
+typedef struct {
+    guint index;
+    const char *name;
+} LayerGroup;
+
+static gint compare_layer_group(gconstpointer a, gconstpointer b) {
+    guint x = ((const LayerGroup*)a)->index, y = ((const LayerGroup*)b)->index;
+    return x < y ? -1 : x > y;
+}
 
+// Layer 0 is the [Crosshair] group so configs written before layers existed
+// keep working; every [Layer N] group follows in order of N, renumbered so
+// gaps left by hand edits close up. Missing keys fall back to the defaults.
+// Returns NULL if the data is not a key file or has no [Crosshair] group, as
+// happens while an editor is halfway through a save.
+static GArray* parse_config_data(const char *data, gsize len) {
+    GKeyFile *kf = g_key_file_new();
+    GError *err = NULL;
+    if (!g_key_file_load_from_data(kf, data, len, G_KEY_FILE_NONE, &err) ||
+        !g_key_file_has_group(kf, "Crosshair")) {
+        g_clear_error(&err);
+        g_key_file_unref(kf);
+        return NULL;
+    }
+
+    // Keys are read back through the group's own name, so [Layer 01] stays
+    // distinct from [Layer 1] even though both parse to the same index.
+    GArray *layer_groups = g_array_new(FALSE, FALSE, sizeof(LayerGroup));
+    char **groups = g_key_file_get_groups(kf, NULL);
+    for (char **g = groups; *g; g++) {
+        if (g_strcmp0(*g, "Crosshair") == 0) continue;
+        guint64 n = 0;
+        if (!g_str_has_prefix(*g, "Layer ") ||
+            !g_ascii_string_to_unsigned(*g + sizeof("Layer ") - 1, 10, 1, G_MAXUINT, &n, NULL)) {
+            g_warning("ignoring unknown config group [%s]", *g);
+            continue;
+        }
+        LayerGroup lg = { (guint)n, *g };
+        g_array_append_val(layer_groups, lg);
+    }
+    g_array_sort(layer_groups, compare_layer_group);
+
+    GArray *cfgs = g_array_new(FALSE, FALSE, sizeof(CrosshairConfig));
+    CrosshairConfig c;
+    crosshair_config_defaults(&c);
+    config_from_keyfile(kf, "Crosshair", &c);
+    g_array_append_val(cfgs, c);
+    for (guint i = 0; i < layer_groups->len; i++) {
+        const LayerGroup *lg = &g_array_index(layer_groups, LayerGroup, i);
+        if (i > 0 && g_array_index(layer_groups, LayerGroup, i - 1).index == lg->index) {
+            g_warning("ignoring config group [%s], layer %u is already defined", lg->name, lg->index);
+            continue;
+        }
+        if (lg->index != cfgs->len)
+            g_warning("config group [%s] loaded as layer %u", lg->name, cfgs->len);
+        crosshair_config_defaults(&c);
+        config_from_keyfile(kf, lg->name, &c);
+        g_array_append_val(cfgs, c);
+    }
+    g_array_unref(layer_groups);
+    g_strfreev(groups);
     g_key_file_unref(kf);
+    return cfgs;
+}
+
+static GArray* load_config(AppState *st) {
+    char *path = hc_get_config_path();
+    char *data = NULL;
+    gsize len = 0;
+    if (!g_file_get_contents(path, &data, &len, NULL)) {
+        g_free(st->config_hash);
+        st->config_hash = hc_config_checksum(NULL, 0);
+        g_free(path);
+        return default_layer_configs();
+    }
+    g_free(st->config_hash);
+    st->config_hash = hc_config_checksum(data, len);
+    GArray *cfgs = parse_config_data(data, len);
+    g_free(data);
     g_free(path);
+    return cfgs ? cfgs : default_layer_configs();
+}
+
+static void frame_snapshot_free(FrameSnapshot *snap) {
+    if (!snap) return;
+    if (snap->surface) cairo_surface_destroy(snap->surface);
+    g_free(snap);
+}
+
+// Only trusted when both the config file bytes and the monitor the overlay
+// lands on at startup are unchanged since it was written.
+static FrameSnapshot* load_snapshot(GdkMonitor *mon) {
+    if (!mon) return NULL;
+    char *dir = hc_get_cache_dir();
+    char *ini = g_build_filename(dir, "snapshot.ini", NULL);
+    char *png = g_build_filename(dir, "snapshot.png", NULL);
+    g_free(dir);
+
+    FrameSnapshot *snap = NULL;
+    GKeyFile *kf = g_key_file_new();
+    char *cfg_hash = NULL, *mon_sig = NULL, *want_hash = NULL, *want_sig = NULL;
+    if (!g_key_file_load_from_file(kf, ini, G_KEY_FILE_NONE, NULL))
+        goto out;
+
+    const char *grp = "Snapshot";
+    cfg_hash = g_key_file_get_string(kf, grp, "config_hash", NULL);
+    mon_sig = g_key_file_get_string(kf, grp, "monitor", NULL);
+    want_hash = hc_read_config_hash();
+    want_sig = hc_monitor_signature(mon);
+    if (!cfg_hash || !mon_sig || g_strcmp0(cfg_hash, want_hash) != 0 || g_strcmp0(mon_sig, want_sig) != 0)
+        goto out;
+
+    int scale = g_key_file_get_integer(kf, grp, "scale", NULL);
+    int frame_w = g_key_file_get_integer(kf, grp, "frame_width", NULL);
+    int frame_h = g_key_file_get_integer(kf, grp, "frame_height", NULL);
+    if (scale < 1 || frame_w < 1 || frame_h < 1)
+        goto out;
+
+    cairo_surface_t *surface = cairo_image_surface_create_from_png(png);
+    if (cairo_surface_status(surface) != CAIRO_STATUS_SUCCESS ||
+        cairo_image_surface_get_width(surface) != frame_w * scale ||
+        cairo_image_surface_get_height(surface) != frame_h * scale) {
+        cairo_surface_destroy(surface);
+        goto out;
+    }
+    cairo_surface_set_device_scale(surface, scale, scale);
+
+    snap = g_new0(FrameSnapshot, 1);
+    snap->surface = surface;
+    snap->x = g_key_file_get_integer(kf, grp, "x", NULL);
+    snap->y = g_key_file_get_integer(kf, grp, "y", NULL);
+    snap->width = g_key_file_get_integer(kf, grp, "width", NULL);
+    snap->height = g_key_file_get_integer(kf, grp, "height", NULL);
+
+out:
+    g_free(cfg_hash);
+    g_free(mon_sig);
+    g_free(want_hash);
+    g_free(want_sig);
+    g_key_file_unref(kf);
+    g_free(ini);
+    g_free(png);
+    return snap;
 }
 
 static gboolean layer_shell_supported(void) {
@@ -201,21 +527,30 @@ static void on_realize_configure_surface(GtkWidget *w, gpointer user_data) {
     set_click_through_and_transparent(w);
 }
 
-static void stroke_with_outline(cairo_t *cr, const CrosshairConfig *c, double base_line_width) {
-    double oa_eff = c->oa * c->outline_opacity;
-    if (c->show_outline && c->outline_thickness > 0.0 && oa_eff > 0.0) {
-        cairo_save(cr);
-        cairo_set_source_rgba(cr, c->or, c->og, c->ob, oa_eff);
+static gboolean outline_enabled(const CrosshairConfig *c) {
+    return c->show_outline && c->outline_thickness > 0.0;
+}
+
+static void stroke_pass(cairo_t *cr, const CrosshairConfig *c, double base_line_width, CrosshairPass pass) {
+    if (pass == PASS_OUTLINE)
         cairo_set_line_width(cr, base_line_width + 2.0 * c->outline_thickness);
-        cairo_stroke_preserve(cr);
-        cairo_restore(cr);
-    }
-    cairo_set_source_rgba(cr, c->r, c->g, c->b, c->a);
-    cairo_set_line_width(cr, base_line_width);
+    else
+        cairo_set_line_width(cr, base_line_width);
     cairo_stroke(cr);
 }
 
-static void draw_crosshair_cairo(cairo_t *cr, int width, int height, const CrosshairConfig *c, double center_dx, double center_dy) {
+static void dot_pass(cairo_t *cr, const CrosshairConfig *c, CrosshairPass pass) {
+    if (pass == PASS_OUTLINE) {
+        cairo_set_line_width(cr, c->outline_thickness * 2.0);
+        cairo_stroke(cr);
+    } else {
+        cairo_fill(cr);
+    }
+}
+
+// Traces one pass of the crosshair shape with the current source; colors are
+// applied later when the resulting masks are composited.
+static void draw_crosshair_cairo(cairo_t *cr, int width, int height, const CrosshairConfig *c, double center_dx, double center_dy, CrosshairPass pass) {
     double cx = width / 2.0 + c->offset_x + center_dx;
     double cy = height / 2.0 + c->offset_y + center_dy;
 
@@ -238,7 +573,7 @@ static void draw_crosshair_cairo(cairo_t *cr, int width, int height, const Cross
             cairo_line_to(cr, cx - gap + align, cy + align);
             cairo_move_to(cr, cx + gap + align, cy + align);
             cairo_line_to(cr, cx + gap + size + align, cy + align);
-            stroke_with_outline(cr, c, c->thickness);
+            stroke_pass(cr, c, c->thickness, pass);
             cairo_restore(cr);
 
             cairo_save(cr);
@@ -247,23 +582,14 @@ static void draw_crosshair_cairo(cairo_t *cr, int width, int height, const Cross
             cairo_line_to(cr, cx + align, cy - gap + align);
             cairo_move_to(cr, cx + align, cy + gap + align);
             cairo_line_to(cr, cx + align, cy + gap + size + align);
-            stroke_with_outline(cr, c, c->thickness);
+            stroke_pass(cr, c, c->thickness, pass);
             cairo_restore(cr);
 
             if (c->style == STYLE_CROSS_DOT) {
                 double r = fmax(1.0, c->thickness * 0.75);
                 cairo_new_path(cr);
                 cairo_arc(cr, cx, cy, r, 0, 2 * G_PI);
-                double oa_eff = c->oa * c->outline_opacity;
-                if (c->show_outline && c->outline_thickness > 0.0 && oa_eff > 0.0) {
-                    cairo_save(cr);
-                    cairo_set_source_rgba(cr, c->or, c->og, c->ob, oa_eff);
-                    cairo_set_line_width(cr, c->outline_thickness * 2.0);
-                    cairo_stroke_preserve(cr);
-                    cairo_restore(cr);
-                }
-                cairo_set_source_rgba(cr, c->r, c->g, c->b, c->a);
-                cairo_fill(cr);
+                dot_pass(cr, c, pass);
             }
         } break;
 
@@ -274,7 +600,7 @@ static void draw_crosshair_cairo(cairo_t *cr, int width, int height, const Cross
             cairo_line_to(cr, cx - gap + align, cy - gap + align);
             cairo_move_to(cr, cx + gap + align, cy + gap + align);
             cairo_line_to(cr, cx + gap + size + align, cy + gap + size + align);
-            stroke_with_outline(cr, c, c->thickness);
+            stroke_pass(cr, c, c->thickness, pass);
             cairo_restore(cr);
 
             cairo_save(cr);
@@ -283,30 +609,21 @@ static void draw_crosshair_cairo(cairo_t *cr, int width, int height, const Cross
             cairo_line_to(cr, cx - gap + align, cy + gap + align);
             cairo_move_to(cr, cx + gap + align, cy - gap + align);
             cairo_line_to(cr, cx + gap + size + align, cy - gap - size + align);
-            stroke_with_outline(cr, c, c->thickness);
+            stroke_pass(cr, c, c->thickness, pass);
             cairo_restore(cr);
         } break;
 
         case STYLE_CIRCLE: {
             cairo_new_path(cr);
             cairo_arc(cr, cx, cy, fmax(1.0, size), 0, 2 * G_PI);
-            stroke_with_outline(cr, c, c->thickness);
+            stroke_pass(cr, c, c->thickness, pass);
         } break;
 
         case STYLE_DOT: {
             double r = fmax(1.0, size * 0.2 + c->thickness * 0.6);
             cairo_new_path(cr);
             cairo_arc(cr, cx, cy, r, 0, 2 * G_PI);
-            double oa_eff = c->oa * c->outline_opacity;
-            if (c->show_outline && c->outline_thickness > 0.0 && oa_eff > 0.0) {
-                cairo_save(cr);
-                cairo_set_source_rgba(cr, c->or, c->og, c->ob, oa_eff);
-                cairo_set_line_width(cr, c->outline_thickness * 2.0);
-                cairo_stroke_preserve(cr);
-                cairo_restore(cr);
-            }
-            cairo_set_source_rgba(cr, c->r, c->g, c->b, c->a);
-            cairo_fill(cr);
+            dot_pass(cr, c, pass);
         } break;
 
         default:
@@ -314,14 +631,414 @@ static void draw_crosshair_cairo(cairo_t *cr, int width, int height, const Cross
     }
 }
 
-static void draw_cb(GtkDrawingArea *area, cairo_t *cr, int width, int height, AppState *st) {
-    (void)area;
+static gboolean crosshair_geometry_equal(const CrosshairConfig *x, const CrosshairConfig *y) {
+    return x->thickness == y->thickness && x->size == y->size && x->gap == y->gap &&
+           x->show_outline == y->show_outline && x->outline_thickness == y->outline_thickness &&
+           x->style == y->style;
+}
+
+static gboolean crosshair_color_equal(const CrosshairConfig *x, const CrosshairConfig *y) {
+    return x->r == y->r && x->g == y->g && x->b == y->b && x->a == y->a &&
+           x->or == y->or && x->og == y->og && x->ob == y->ob && x->oa == y->oa &&
+           x->outline_opacity == y->outline_opacity;
+}
+
+static ConfigChange crosshair_config_diff(const CrosshairConfig *old, const CrosshairConfig *new_cfg) {
+    ConfigChange changes = CFG_CHANGED_NONE;
+    if (old->offset_x != new_cfg->offset_x || old->offset_y != new_cfg->offset_y)
+        changes |= CFG_CHANGED_OFFSET;
+    if (!crosshair_color_equal(old, new_cfg))
+        changes |= CFG_CHANGED_COLOR;
+    if (!crosshair_geometry_equal(old, new_cfg))
+        changes |= CFG_CHANGED_GEOMETRY;
+    if (old->visible != new_cfg->visible)
+        changes |= CFG_CHANGED_VISIBILITY;
+    return changes;
+}
+
+static gboolean raster_key_equal(const RasterKey *a, const RasterKey *b) {
+    return crosshair_geometry_equal(&a->cfg, &b->cfg) &&
+           a->frac_x == b->frac_x && a->frac_y == b->frac_y && a->scale == b->scale;
+}
+
+static int crosshair_half_extent(const CrosshairConfig *c) {
+    double reach = fmax(c->gap + c->size, fmax(1.0, c->size));
+    double pad = c->thickness + 2.0 * c->outline_thickness + 2.0;
+    return (int)ceil(reach + pad);
+}
+
+static void crosshair_raster_free(CrosshairRaster *r) {
+    if (!r) return;
+    if (r->fill) cairo_surface_destroy(r->fill);
+    if (r->outline) cairo_surface_destroy(r->outline);
+    g_free(r);
+}
+
+static cairo_surface_t* rasterize_pass(const RasterKey *key, int side, CrosshairPass pass) {
+    int scale = MAX(key->scale, 1);
+    cairo_surface_t *mask = cairo_image_surface_create(CAIRO_FORMAT_A8, side * scale, side * scale);
+    cairo_surface_set_device_scale(mask, scale, scale);
+
+    cairo_t *cr = cairo_create(mask);
+    cairo_set_source_rgba(cr, 0.0, 0.0, 0.0, 1.0);
+    draw_crosshair_cairo(cr, side, side, &key->cfg, key->frac_x, key->frac_y, pass);
+    cairo_destroy(cr);
+    cairo_surface_flush(mask);
+    return mask;
+}
+
+// Returns NULL if the job is superseded between the two passes.
+static CrosshairRaster* rasterize_crosshair(const RasterKey *key, GCancellable *cancellable) {
+    CrosshairRaster *r = g_new0(CrosshairRaster, 1);
+    r->key = *key;
+    r->half = crosshair_half_extent(&key->cfg);
+
+    int side = 2 * r->half;
+    r->fill = rasterize_pass(key, side, PASS_FILL);
+    if (outline_enabled(&key->cfg)) {
+        if (g_cancellable_is_cancelled(cancellable)) {
+            crosshair_raster_free(r);
+            return NULL;
+        }
+        r->outline = rasterize_pass(key, side, PASS_OUTLINE);
+    }
+    return r;
+}
+
+static void paint_crosshair_raster(cairo_t *cr, const CrosshairRaster *r, const CrosshairConfig *c, double x, double y) {
+    double oa_eff = c->oa * c->outline_opacity;
+    if (r->outline && oa_eff > 0.0) {
+        cairo_set_source_rgba(cr, c->or, c->og, c->ob, oa_eff);
+        cairo_mask_surface(cr, r->outline, x, y);
+    }
+    cairo_set_source_rgba(cr, c->r, c->g, c->b, c->a);
+    cairo_mask_surface(cr, r->fill, x, y);
+}
+
+static void raster_thread(GTask *task, gpointer source, gpointer task_data, GCancellable *cancellable) {
+    (void)source;
+    if (g_task_return_error_if_cancelled(task)) return;
+    RasterJob *job = task_data;
+    CrosshairRaster *r = rasterize_crosshair(&job->key, cancellable);
+    if (!r) {
+        g_task_return_error_if_cancelled(task);
+        return;
+    }
+    g_task_return_pointer(task, r, (GDestroyNotify)crosshair_raster_free);
+}
+
+// The cached frame covers every layer, so it stays up until each visible
+// layer can draw itself.
+static void release_snapshot_if_ready(AppState *st) {
+    if (!st->snapshot || st->startup_pending) return;
+    for (guint i = 0; i < st->layers->len; i++) {
+        CrosshairLayer *layer = g_ptr_array_index(st->layers, i);
+        if (layer->cfg.visible && !layer->raster) return;
+    }
+    g_clear_pointer(&st->snapshot, frame_snapshot_free);
+    queue_redraw(st);
+}
+
+static void place_layer(CrosshairLayer *layer);
+
+static void on_raster_ready(GObject *source, GAsyncResult *res, gpointer user_data) {
+    (void)source;
+    AppState *st = user_data;
+    const RasterJob *job = g_task_get_task_data(G_TASK(res));
+    GError *err = NULL;
+    CrosshairRaster *r = g_task_propagate_pointer(G_TASK(res), &err);
+    if (!r) {
+        // Cancelled jobs were superseded; the newer one still owns the pending state.
+        g_clear_error(&err);
+        return;
+    }
+    CrosshairLayer *layer = find_layer(st, job->layer_id);
+    if (!layer) {
+        crosshair_raster_free(r);
+        return;
+    }
+    layer->raster_pending = FALSE;
+    g_clear_object(&layer->raster_cancel);
+    crosshair_raster_free(layer->raster);
+    layer->raster = r;
+    layer->raster_serial++;
+    place_layer(layer);
+    queue_layer_redraw(layer);
+    schedule_snapshot_save(st);
+    release_snapshot_if_ready(st);
+}
+
+static void cancel_raster(CrosshairLayer *layer) {
+    if (layer->raster_cancel) {
+        g_cancellable_cancel(layer->raster_cancel);
+        g_clear_object(&layer->raster_cancel);
+    }
+    layer->raster_pending = FALSE;
+}
+
+static void request_raster(CrosshairLayer *layer, const RasterKey *key) {
+    if (layer->raster && raster_key_equal(&layer->raster->key, key)) {
+        cancel_raster(layer);
+        return;
+    }
+    if (layer->raster_pending && raster_key_equal(&layer->pending_key, key)) return;
+
+    cancel_raster(layer);
+    layer->raster_cancel = g_cancellable_new();
+    layer->pending_key = *key;
+    layer->raster_pending = TRUE;
+
+    RasterJob *job = g_new0(RasterJob, 1);
+    job->layer_id = layer->id;
+    job->key = *key;
+    GTask *task = g_task_new(NULL, layer->raster_cancel, on_raster_ready, layer->st);
+    g_task_set_task_data(task, job, g_free);
+    g_task_run_in_thread(task, raster_thread);
+    g_object_unref(task);
+}
+
+typedef struct {
+    cairo_surface_t *frame;
+    char *png_path;
+    char *ini_path;
+    char *meta;
+    gsize meta_len;
+} SnapshotJob;
+
+static void snapshot_job_free(SnapshotJob *job) {
+    cairo_surface_destroy(job->frame);
+    g_free(job->png_path);
+    g_free(job->ini_path);
+    g_free(job->meta);
+    g_free(job);
+}
+
+static cairo_status_t append_png_bytes(void *closure, const unsigned char *data, unsigned int length) {
+    g_byte_array_append(closure, data, length);
+    return CAIRO_STATUS_SUCCESS;
+}
+
+// Held across the cancellation check and the writes so a superseded save can
+// never land on top of a newer one.
+static GMutex snapshot_write_lock;
+
+static void save_snapshot_thread(GTask *task, gpointer source, gpointer task_data, GCancellable *cancellable) {
+    (void)source; (void)cancellable;
+    SnapshotJob *job = task_data;
+    GByteArray *png = g_byte_array_new();
+    if (cairo_surface_write_to_png_stream(job->frame, append_png_bytes, png) != CAIRO_STATUS_SUCCESS) {
+        g_byte_array_unref(png);
+        g_task_return_boolean(task, FALSE);
+        return;
+    }
+
+    g_mutex_lock(&snapshot_write_lock);
+    if (!g_task_return_error_if_cancelled(task)) {
+        gboolean ok = g_file_set_contents(job->png_path, (const char*)png->data, png->len, NULL) &&
+                      g_file_set_contents(job->ini_path, job->meta, job->meta_len, NULL);
+        g_task_return_boolean(task, ok);
+    }
+    g_mutex_unlock(&snapshot_write_lock);
+    g_byte_array_unref(png);
+}
 
+// Writes the cache for the current config hash. sync is for shutdown, where
+// the process may exit before a worker gets to run.
+static void save_snapshot(AppState *st, gboolean sync) {
+    if (!st->layers || !st->config_hash || !st->monitors || !st->monitor_dropdown)
+        return;
+    // While the cached frame is up some layers may still lack a raster.
+    if (st->snapshot || st->startup_pending)
+        return;
+    guint idx = gtk_drop_down_get_selected(st->monitor_dropdown);
+    if (idx >= st->monitors->len)
+        return;
+
+    // A pending raster means the geometry on screen no longer matches the
+    // config; on_raster_ready schedules the save again once it lands.
+    for (guint i = 0; i < st->layers->len; i++) {
+        CrosshairLayer *layer = g_ptr_array_index(st->layers, i);
+        if (layer->cfg.visible && layer->raster_pending) return;
+    }
+
+    // Composite the visible layers into the smallest frame that holds them all.
+    int x0 = G_MAXINT, y0 = G_MAXINT, x1 = G_MININT, y1 = G_MININT;
+    int scale = 1;
+    for (guint i = 0; i < st->layers->len; i++) {
+        CrosshairLayer *layer = g_ptr_array_index(st->layers, i);
+        if (!layer->cfg.visible || !layer->raster) continue;
+        int side = 2 * layer->raster->half;
+        x0 = MIN(x0, layer->blit_x);
+        y0 = MIN(y0, layer->blit_y);
+        x1 = MAX(x1, layer->blit_x + side);
+        y1 = MAX(y1, layer->blit_y + side);
+        scale = MAX(layer->raster->key.scale, 1);
+    }
+    // Only what is on screen is worth caching; offsets can push layers past the edge.
+    x0 = MAX(x0, 0);
+    y0 = MAX(y0, 0);
+    x1 = MIN(x1, st->area_width);
+    y1 = MIN(y1, st->area_height);
+    if (x0 >= x1 || y0 >= y1)
+        return;
+
+    // The rasters are immutable, so only this composite has to happen here;
+    // encoding and writing the PNG is left to a worker.
+    cairo_surface_t *frame = cairo_image_surface_create(CAIRO_FORMAT_ARGB32, (x1 - x0) * scale, (y1 - y0) * scale);
+    cairo_surface_set_device_scale(frame, scale, scale);
+    cairo_t *cr = cairo_create(frame);
+    for (guint i = 0; i < st->layers->len; i++) {
+        CrosshairLayer *layer = g_ptr_array_index(st->layers, i);
+        if (!layer->cfg.visible || !layer->raster) continue;
+        paint_crosshair_raster(cr, layer->raster, &layer->cfg, layer->blit_x - x0, layer->blit_y - y0);
+    }
+    cairo_destroy(cr);
+    cairo_surface_flush(frame);
+
+    GKeyFile *kf = g_key_file_new();
+    const char *grp = "Snapshot";
+    char *sig = hc_monitor_signature(g_ptr_array_index(st->monitors, idx));
+    g_key_file_set_string(kf, grp, "config_hash", st->config_hash);
+    g_key_file_set_string(kf, grp, "monitor", sig);
+    g_key_file_set_integer(kf, grp, "scale", scale);
+    g_key_file_set_integer(kf, grp, "frame_width", x1 - x0);
+    g_key_file_set_integer(kf, grp, "frame_height", y1 - y0);
+    g_key_file_set_integer(kf, grp, "x", x0);
+    g_key_file_set_integer(kf, grp, "y", y0);
+    g_key_file_set_integer(kf, grp, "width", st->area_width);
+    g_key_file_set_integer(kf, grp, "height", st->area_height);
+    g_free(sig);
+
+    char *dir = hc_get_cache_dir();
+    SnapshotJob *job = g_new0(SnapshotJob, 1);
+    job->frame = frame;
+    job->png_path = g_build_filename(dir, "snapshot.png", NULL);
+    job->ini_path = g_build_filename(dir, "snapshot.ini", NULL);
+    job->meta = g_key_file_to_data(kf, &job->meta_len, NULL);
+    g_key_file_unref(kf);
+    g_free(dir);
+
+    if (st->snapshot_cancel)
+        g_cancellable_cancel(st->snapshot_cancel);
+    g_clear_object(&st->snapshot_cancel);
+    st->snapshot_cancel = g_cancellable_new();
+
+    GTask *task = g_task_new(NULL, st->snapshot_cancel, NULL, NULL);
+    g_task_set_task_data(task, job, (GDestroyNotify)snapshot_job_free);
+    if (sync)
+        g_task_run_in_thread_sync(task, save_snapshot_thread);
+    else
+        g_task_run_in_thread(task, save_snapshot_thread);
+    g_object_unref(task);
+}
+
+static gboolean save_snapshot_cb(gpointer user_data) {
+    AppState *st = user_data;
+    st->snapshot_save_id = 0;
+    save_snapshot(st, FALSE);
+    return G_SOURCE_REMOVE;
+}
+
+static void schedule_snapshot_save(AppState *st) {
+    if (st->snapshot_save_id)
+        g_source_remove(st->snapshot_save_id);
+    st->snapshot_save_id = g_timeout_add_seconds(1, save_snapshot_cb, st);
+}
+
+static void first_frame_done(AppState *st, gint64 presented) {
+    double committed_ms = (st->first_frame_commit - hc_start_time) / 1000.0;
+    const char *source = st->first_frame_cached ? "cached snapshot" : "rendered";
+    if (presented)
+        g_debug("first crosshair frame (%s): committed after %.1f ms, presented after %.1f ms",
+                source, committed_ms, (presented - hc_start_time) / 1000.0);
+    else
+        g_debug("first crosshair frame (%s): committed after %.1f ms, presentation time unavailable",
+                source, committed_ms);
+    g_clear_object(&st->first_frame_clock);
+}
+
+// Presentation feedback arrives after the frame, so poll its timings for a
+// second before settling for the commit time.
+static gboolean poll_first_frame_cb(gpointer user_data) {
+    AppState *st = user_data;
+    GdkFrameTimings *t = gdk_frame_clock_get_timings(st->first_frame_clock, st->first_frame_counter);
+    if (t && gdk_frame_timings_get_complete(t)) {
+        first_frame_done(st, gdk_frame_timings_get_presentation_time(t));
+        return G_SOURCE_REMOVE;
+    }
+    if (!t || ++st->first_frame_polls >= 60) {
+        first_frame_done(st, 0);
+        return G_SOURCE_REMOVE;
+    }
+    return G_SOURCE_CONTINUE;
+}
+
+static void on_first_frame_painted(GdkFrameClock *clock, AppState *st) {
+    g_signal_handler_disconnect(clock, st->first_frame_handler);
+    st->first_frame_handler = 0;
+    st->first_frame_commit = g_get_monotonic_time();
+    st->first_frame_counter = gdk_frame_clock_get_frame_counter(clock);
+    st->first_frame_clock = g_object_ref(clock);
+    g_timeout_add(16, poll_first_frame_cb, st);
+}
+
+// Startup is measured up to the frame that first carries a crosshair, not
+// up to the draw call that produced it.
+static void log_first_frame(AppState *st, gboolean from_snapshot) {
+    if (st->first_frame_logged) return;
+    st->first_frame_logged = TRUE;
+    st->first_frame_cached = from_snapshot;
+    GdkFrameClock *clock = gtk_widget_get_frame_clock(GTK_WIDGET(st->overlay));
+    if (!clock) {
+        st->first_frame_commit = g_get_monotonic_time();
+        first_frame_done(st, 0);
+        return;
+    }
+    st->first_frame_handler = g_signal_connect(clock, "after-paint", G_CALLBACK(on_first_frame_painted), st);
+}
+
+static gboolean paint_snapshot(AppState *st, cairo_t *cr, int width, int height) {
+    FrameSnapshot *snap = st->snapshot;
+    if (!snap || snap->width != width || snap->height != height) return FALSE;
+    cairo_set_source_surface(cr, snap->surface, snap->x, snap->y);
+    cairo_paint(cr);
+    log_first_frame(st, TRUE);
+    return TRUE;
+}
+
+static void clear_area(cairo_t *cr) {
     cairo_save(cr);
     cairo_set_operator(cr, CAIRO_OPERATOR_SOURCE);
     cairo_set_source_rgba(cr, 0.0, 0.0, 0.0, 0.0);
     cairo_paint(cr);
     cairo_restore(cr);
+}
+
+static void finish_startup(AppState *st);
+
+static gboolean finish_startup_idle(gpointer user_data) {
+    AppState *st = user_data;
+    st->finish_startup_id = 0;
+    finish_startup(st);
+    return G_SOURCE_REMOVE;
+}
+
+// The base area sits beneath the layers and only ever shows the cached frame.
+static void draw_cb(GtkDrawingArea *area, cairo_t *cr, int width, int height, AppState *st) {
+    (void)area;
+    clear_area(cr);
+    paint_snapshot(st, cr, width, height);
+
+    // The cached frame goes out first; the rest of startup runs once it is committed.
+    if (st->startup_pending && !st->finish_startup_id)
+        st->finish_startup_id = g_idle_add(finish_startup_idle, st);
+}
+
+// Works out where the layer's crosshair lands on the overlay, asks for a
+// matching raster and moves the layer's area over the current one.
+static void place_layer(CrosshairLayer *layer) {
+    AppState *st = layer->st;
+    if (!layer->cfg.visible || st->area_width <= 0 || st->area_height <= 0) return;
 
     double dx = 0.0, dy = 0.0;
     if (st->monitors && st->monitors->len > 0 && st->monitor_dropdown) {
@@ -331,67 +1048,179 @@ static void draw_cb(GtkDrawingArea *area, cairo_t *cr, int width, int height, Ap
             if (mon) {
                 GdkRectangle geo = {0};
                 gdk_monitor_get_geometry(mon, &geo);
-                dx = (width  - geo.width)  / 2.0;
-                dy = (height - geo.height) / 2.0;
+                dx = (st->area_width  - geo.width)  / 2.0;
+                dy = (st->area_height - geo.height) / 2.0;
             }
         }
     }
 
-    draw_crosshair_cairo(cr, width, height, &st->cfg, dx, dy);
+    double cx = st->area_width / 2.0 + layer->cfg.offset_x + dx;
+    double cy = st->area_height / 2.0 + layer->cfg.offset_y + dy;
+    double ix = floor(cx), iy = floor(cy);
+
+    RasterKey key = {0};
+    key.cfg = layer->cfg;
+    key.cfg.offset_x = 0.0;
+    key.cfg.offset_y = 0.0;
+    key.frac_x = cx - ix;
+    key.frac_y = cy - iy;
+    key.scale = gtk_widget_get_scale_factor(GTK_WIDGET(st->overlay));
+    request_raster(layer, &key);
+
+    // Until the worker delivers, keep the previous raster at the new position.
+    if (!layer->raster) return;
+
+    int side = 2 * layer->raster->half;
+    int bx = (int)ix - layer->raster->half;
+    int by = (int)iy - layer->raster->half;
+    gtk_drawing_area_set_content_width(layer->area, side);
+    gtk_drawing_area_set_content_height(layer->area, side);
+    if (layer->blit_x != bx || layer->blit_y != by) {
+        gtk_fixed_move(st->layer_fixed, GTK_WIDGET(layer->area), bx, by);
+        layer->blit_x = bx;
+        layer->blit_y = by;
+        schedule_snapshot_save(st);
+    }
+}
+
+static void relayout_layers(AppState *st) {
+    for (guint i = 0; st->layers && i < st->layers->len; i++)
+        place_layer(g_ptr_array_index(st->layers, i));
+}
+
+static void on_area_resize(GtkDrawingArea *area, int width, int height, AppState *st) {
+    (void)area;
+    if (st->area_width == width && st->area_height == height) return;
+    st->area_width = width;
+    st->area_height = height;
+    relayout_layers(st);
+    schedule_snapshot_save(st);
+}
+
+static void on_scale_factor_changed(GObject *obj, GParamSpec *pspec, AppState *st) {
+    (void)obj; (void)pspec;
+    relayout_layers(st);
+}
+
+static void layer_draw_cb(GtkDrawingArea *area, cairo_t *cr, int width, int height, CrosshairLayer *layer) {
+    (void)area; (void)width; (void)height;
+    AppState *st = layer->st;
+    // While the cached frame is up it already covers this layer.
+    if (!layer->raster || st->snapshot) return;
+
+    paint_crosshair_raster(cr, layer->raster, &layer->cfg, 0, 0);
+    log_first_frame(st, FALSE);
+
+    if (layer->blit_serial != layer->raster_serial ||
+        !crosshair_color_equal(&layer->blit_cfg, &layer->cfg)) {
+        layer->blit_serial = layer->raster_serial;
+        layer->blit_cfg = layer->cfg;
+        schedule_snapshot_save(st);
+    }
+}
+
+static void update_layer(CrosshairLayer *layer, ConfigChange changes) {
+    if (changes & (CFG_CHANGED_OFFSET | CFG_CHANGED_GEOMETRY))
+        place_layer(layer);
+    if (changes & CFG_CHANGED_COLOR)
+        queue_layer_redraw(layer);
+}
+
+static CrosshairLayer* crosshair_layer_new(AppState *st, const CrosshairConfig *cfg) {
+    CrosshairLayer *layer = g_new0(CrosshairLayer, 1);
+    layer->st = st;
+    layer->id = ++st->next_layer_id;
+    layer->cfg = *cfg;
+
+    layer->area = GTK_DRAWING_AREA(gtk_drawing_area_new());
+    gtk_widget_set_can_target(GTK_WIDGET(layer->area), FALSE);
+    gtk_widget_set_visible(GTK_WIDGET(layer->area), cfg->visible);
+    gtk_drawing_area_set_draw_func(layer->area, (GtkDrawingAreaDrawFunc)layer_draw_cb, layer, NULL);
+    gtk_fixed_put(st->layer_fixed, GTK_WIDGET(layer->area), 0, 0);
+    place_layer(layer);
+    return layer;
+}
+
+static void crosshair_layer_free(CrosshairLayer *layer) {
+    if (!layer) return;
+    cancel_raster(layer);
+    if (layer->area)
+        gtk_fixed_remove(layer->st->layer_fixed, GTK_WIDGET(layer->area));
+    crosshair_raster_free(layer->raster);
+    g_free(layer);
+}
+
+static void set_layer_visible(CrosshairLayer *layer, gboolean visible) {
+    layer->cfg.visible = visible;
+    gtk_widget_set_visible(GTK_WIDGET(layer->area), visible);
+    place_layer(layer);
+    schedule_snapshot_save(layer->st);
+    release_snapshot_if_ready(layer->st);
 }
 
 static void on_color_changed(GtkColorDialogButton *btn, GParamSpec *pspec, AppState *st) {
     (void)pspec;
+    if (st->syncing_widgets) return;
+    CrosshairLayer *layer = active_layer(st);
     const GdkRGBA *rgba = gtk_color_dialog_button_get_rgba(btn);
     if (rgba) {
-        st->cfg.r = rgba->red;
-        st->cfg.g = rgba->green;
-        st->cfg.b = rgba->blue;
-        st->cfg.a = rgba->alpha;
+        layer->cfg.r = rgba->red;
+        layer->cfg.g = rgba->green;
+        layer->cfg.b = rgba->blue;
+        layer->cfg.a = rgba->alpha;
         save_config(st);
-        queue_redraw(st);
+        queue_layer_redraw(layer);
     }
 }
 
 static void on_outline_color_changed(GtkColorDialogButton *btn, GParamSpec *pspec, AppState *st) {
     (void)pspec;
+    if (st->syncing_widgets) return;
+    CrosshairLayer *layer = active_layer(st);
     const GdkRGBA *rgba = gtk_color_dialog_button_get_rgba(btn);
     if (rgba) {
-        st->cfg.or = rgba->red;
-        st->cfg.og = rgba->green;
-        st->cfg.ob = rgba->blue;
-        st->cfg.oa = rgba->alpha;
+        layer->cfg.or = rgba->red;
+        layer->cfg.og = rgba->green;
+        layer->cfg.ob = rgba->blue;
+        layer->cfg.oa = rgba->alpha;
         save_config(st);
-        queue_redraw(st);
+        queue_layer_redraw(layer);
     }
 }
 
 static void on_scale_value(GtkRange *range, AppState *st) {
+    if (st->syncing_widgets) return;
+    CrosshairLayer *layer = active_layer(st);
+    CrosshairConfig old = layer->cfg;
     double v = gtk_range_get_value(range);
-    if (range == GTK_RANGE(st->thickness_scale)) st->cfg.thickness = v;
-    else if (range == GTK_RANGE(st->size_scale)) st->cfg.size = v;
-    else if (range == GTK_RANGE(st->gap_scale)) st->cfg.gap = v;
-    else if (range == GTK_RANGE(st->opacity_scale)) st->cfg.a = v;
-    else if (range == GTK_RANGE(st->outline_thickness_scale)) st->cfg.outline_thickness = v;
-    else if (range == GTK_RANGE(st->outline_opacity_scale)) st->cfg.outline_opacity = v;
+    if (range == GTK_RANGE(st->thickness_scale)) layer->cfg.thickness = v;
+    else if (range == GTK_RANGE(st->size_scale)) layer->cfg.size = v;
+    else if (range == GTK_RANGE(st->gap_scale)) layer->cfg.gap = v;
+    else if (range == GTK_RANGE(st->opacity_scale)) layer->cfg.a = v;
+    else if (range == GTK_RANGE(st->outline_thickness_scale)) layer->cfg.outline_thickness = v;
+    else if (range == GTK_RANGE(st->outline_opacity_scale)) layer->cfg.outline_opacity = v;
     save_config(st);
-    queue_redraw(st);
+    update_layer(layer, crosshair_config_diff(&old, &layer->cfg));
 }
 
 static void on_outline_toggled(GtkSwitch *sw, GParamSpec *pspec, AppState *st) {
     (void)pspec;
-    st->cfg.show_outline = gtk_switch_get_active(sw);
+    if (st->syncing_widgets) return;
+    CrosshairLayer *layer = active_layer(st);
+    layer->cfg.show_outline = gtk_switch_get_active(sw);
     save_config(st);
-    queue_redraw(st);
+    update_layer(layer, CFG_CHANGED_GEOMETRY);
 }
 
 static void on_style_changed(GObject *obj, GParamSpec *pspec, AppState *st) {
     (void)obj; (void)pspec;
+    if (st->syncing_widgets) return;
+    CrosshairLayer *layer = active_layer(st);
     guint idx = gtk_drop_down_get_selected(st->style_dropdown);
     if (idx >= STYLE_COUNT) idx = STYLE_CROSS;
-    st->cfg.style = (CrosshairStyle)idx;
+    layer->cfg.style = (CrosshairStyle)idx;
     save_config(st);
-    queue_redraw(st);
+    update_layer(layer, CFG_CHANGED_GEOMETRY);
 }
 
 static void update_default_size_to_monitor(AppState *st) {
@@ -436,17 +1265,19 @@ static void on_monitor_changed(GObject *obj, GParamSpec *pspec, AppState *st) {
     set_overlay_monitor(st, idx);
     if (!st->using_layer_shell)
         update_default_size_to_monitor(st);
-    queue_redraw(st);
+    relayout_layers(st);
 }
 
 static void on_position_changed(GtkSpinButton *spin, AppState *st) {
+    if (st->syncing_widgets) return;
+    CrosshairLayer *layer = active_layer(st);
     if (spin == st->posx_spin) {
-        st->cfg.offset_x = gtk_spin_button_get_value(spin);
+        layer->cfg.offset_x = gtk_spin_button_get_value(spin);
     } else if (spin == st->posy_spin) {
-        st->cfg.offset_y = gtk_spin_button_get_value(spin);
+        layer->cfg.offset_y = gtk_spin_button_get_value(spin);
     }
     save_config(st);
-    queue_redraw(st);
+    update_layer(layer, CFG_CHANGED_OFFSET);
 }
 
 static GtkWidget* labeled_row_widget(const char *title, GtkWidget *child) {
@@ -497,6 +1328,67 @@ static void populate_monitors(AppState *st) {
     g_free(names);
 }
 
+static void sync_widgets_from_config(AppState *st, ConfigChange changes);
+
+static void refresh_layer_list(AppState *st) {
+    guint n = st->layers->len;
+    GStrv names = g_new0(char*, n + 1);
+    for (guint i = 0; i < n; i++)
+        names[i] = i == 0 ? g_strdup("Layer 0 (base)") : g_strdup_printf("Layer %u", i);
+
+    gboolean was_syncing = st->syncing_widgets;
+    st->syncing_widgets = TRUE;
+    GtkStringList *list = gtk_string_list_new((const char * const*)names);
+    gtk_drop_down_set_model(st->layer_dropdown, G_LIST_MODEL(list));
+    g_object_unref(list);
+    gtk_drop_down_set_selected(st->layer_dropdown, st->active_layer);
+    st->syncing_widgets = was_syncing;
+
+    g_strfreev(names);
+}
+
+static void on_layer_selected(GObject *obj, GParamSpec *pspec, AppState *st) {
+    (void)obj; (void)pspec;
+    if (st->syncing_widgets) return;
+    guint idx = gtk_drop_down_get_selected(st->layer_dropdown);
+    if (idx >= st->layers->len) return;
+    st->active_layer = idx;
+    gtk_widget_set_sensitive(GTK_WIDGET(st->remove_layer_button), idx > 0);
+    sync_widgets_from_config(st, CFG_CHANGED_ALL);
+}
+
+static void on_visible_toggled(GtkSwitch *sw, GParamSpec *pspec, AppState *st) {
+    (void)pspec;
+    if (st->syncing_widgets) return;
+    set_layer_visible(active_layer(st), gtk_switch_get_active(sw));
+    save_config(st);
+}
+
+static void on_add_layer(GtkButton *button, AppState *st) {
+    (void)button;
+    // Start from the layer being edited so a variant is one tweak away.
+    CrosshairConfig cfg = active_layer(st)->cfg;
+    cfg.visible = TRUE;
+    g_ptr_array_add(st->layers, crosshair_layer_new(st, &cfg));
+    st->active_layer = st->layers->len - 1;
+    refresh_layer_list(st);
+    gtk_widget_set_sensitive(GTK_WIDGET(st->remove_layer_button), TRUE);
+    sync_widgets_from_config(st, CFG_CHANGED_ALL);
+    save_config(st);
+}
+
+static void on_remove_layer(GtkButton *button, AppState *st) {
+    (void)button;
+    if (st->active_layer == 0) return;
+    g_ptr_array_remove_index(st->layers, st->active_layer);
+    st->active_layer--;
+    refresh_layer_list(st);
+    gtk_widget_set_sensitive(GTK_WIDGET(st->remove_layer_button), st->active_layer > 0);
+    sync_widgets_from_config(st, CFG_CHANGED_ALL);
+    save_config(st);
+    schedule_snapshot_save(st);
+}
+
 static GtkWidget* build_preferences(AppState *st) {
     st->prefs = ADW_PREFERENCES_WINDOW(adw_preferences_window_new());
     gtk_window_set_application(GTK_WINDOW(st->prefs), GTK_APPLICATION(st->app));
@@ -505,6 +1397,32 @@ static GtkWidget* build_preferences(AppState *st) {
     AdwPreferencesPage *page = ADW_PREFERENCES_PAGE(adw_preferences_page_new());
     adw_preferences_window_add(st->prefs, page);
 
+    const CrosshairConfig *cfg = &active_layer(st)->cfg;
+
+    AdwPreferencesGroup *layer_group = ADW_PREFERENCES_GROUP(adw_preferences_group_new());
+    adw_preferences_group_set_title(layer_group, "Layer");
+    adw_preferences_page_add(page, layer_group);
+
+    st->layer_dropdown = GTK_DROP_DOWN(gtk_drop_down_new(NULL, NULL));
+    refresh_layer_list(st);
+    g_signal_connect(st->layer_dropdown, "notify::selected", G_CALLBACK(on_layer_selected), st);
+    adw_preferences_group_add(layer_group, labeled_row_widget("Editing", GTK_WIDGET(st->layer_dropdown)));
+
+    st->visible_switch = GTK_SWITCH(gtk_switch_new());
+    gtk_switch_set_active(st->visible_switch, cfg->visible);
+    g_signal_connect(st->visible_switch, "notify::active", G_CALLBACK(on_visible_toggled), st);
+    adw_preferences_group_add(layer_group, labeled_row_widget("Visible", GTK_WIDGET(st->visible_switch)));
+
+    GtkWidget *layer_buttons = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 6);
+    GtkWidget *add_button = gtk_button_new_with_label("Add");
+    g_signal_connect(add_button, "clicked", G_CALLBACK(on_add_layer), st);
+    gtk_box_append(GTK_BOX(layer_buttons), add_button);
+    st->remove_layer_button = GTK_BUTTON(gtk_button_new_with_label("Remove"));
+    gtk_widget_set_sensitive(GTK_WIDGET(st->remove_layer_button), st->active_layer > 0);
+    g_signal_connect(st->remove_layer_button, "clicked", G_CALLBACK(on_remove_layer), st);
+    gtk_box_append(GTK_BOX(layer_buttons), GTK_WIDGET(st->remove_layer_button));
+    adw_preferences_group_add(layer_group, labeled_row_widget("Layers", layer_buttons));
+
     AdwPreferencesGroup *style_group = ADW_PREFERENCES_GROUP(adw_preferences_group_new());
     adw_preferences_group_set_title(style_group, "Style");
     adw_preferences_page_add(page, style_group);
@@ -512,7 +1430,7 @@ static GtkWidget* build_preferences(AppState *st) {
     st->style_dropdown = GTK_DROP_DOWN(gtk_drop_down_new_from_strings(
         (const char *[]){"Cross", "X", "Circle", "Dot", "Cross + Dot", NULL}
     ));
-    gtk_drop_down_set_selected(st->style_dropdown, st->cfg.style);
+    gtk_drop_down_set_selected(st->style_dropdown, cfg->style);
     g_signal_connect(st->style_dropdown, "notify::selected", G_CALLBACK(on_style_changed), st);
     gtk_widget_set_size_request(GTK_WIDGET(st->style_dropdown), 220, -1);
     gtk_widget_set_hexpand(GTK_WIDGET(st->style_dropdown), TRUE);
@@ -520,33 +1438,33 @@ static GtkWidget* build_preferences(AppState *st) {
 
     st->color_button = GTK_COLOR_DIALOG_BUTTON(gtk_color_dialog_button_new(gtk_color_dialog_new()));
     {
-        GdkRGBA rgba = { st->cfg.r, st->cfg.g, st->cfg.b, st->cfg.a };
+        GdkRGBA rgba = { cfg->r, cfg->g, cfg->b, cfg->a };
         gtk_color_dialog_button_set_rgba(st->color_button, &rgba);
     }
     g_signal_connect(st->color_button, "notify::rgba", G_CALLBACK(on_color_changed), st);
     adw_preferences_group_add(style_group, labeled_row_widget("Color", GTK_WIDGET(st->color_button)));
 
     st->thickness_scale = GTK_SCALE(gtk_scale_new_with_range(GTK_ORIENTATION_HORIZONTAL, 1.0, 20.0, 0.5));
-    gtk_range_set_value(GTK_RANGE(st->thickness_scale), st->cfg.thickness);
+    gtk_range_set_value(GTK_RANGE(st->thickness_scale), cfg->thickness);
     gtk_widget_set_hexpand(GTK_WIDGET(st->thickness_scale), TRUE);
     gtk_scale_set_draw_value(st->thickness_scale, TRUE);
     g_signal_connect(st->thickness_scale, "value-changed", G_CALLBACK(on_scale_value), st);
     adw_preferences_group_add(style_group, labeled_row_widget("Thickness", GTK_WIDGET(st->thickness_scale)));
 
     st->size_scale = GTK_SCALE(gtk_scale_new_with_range(GTK_ORIENTATION_HORIZONTAL, 2.0, 400.0, 1.0));
-    gtk_range_set_value(GTK_RANGE(st->size_scale), st->cfg.size);
+    gtk_range_set_value(GTK_RANGE(st->size_scale), cfg->size);
     gtk_scale_set_draw_value(st->size_scale, TRUE);
     g_signal_connect(st->size_scale, "value-changed", G_CALLBACK(on_scale_value), st);
     adw_preferences_group_add(style_group, labeled_row_widget("Size", GTK_WIDGET(st->size_scale)));
 
     st->gap_scale = GTK_SCALE(gtk_scale_new_with_range(GTK_ORIENTATION_HORIZONTAL, 0.0, 150.0, 1.0));
-    gtk_range_set_value(GTK_RANGE(st->gap_scale), st->cfg.gap);
+    gtk_range_set_value(GTK_RANGE(st->gap_scale), cfg->gap);
     gtk_scale_set_draw_value(st->gap_scale, TRUE);
     g_signal_connect(st->gap_scale, "value-changed", G_CALLBACK(on_scale_value), st);
     adw_preferences_group_add(style_group, labeled_row_widget("Gap", GTK_WIDGET(st->gap_scale)));
 
     st->opacity_scale = GTK_SCALE(gtk_scale_new_with_range(GTK_ORIENTATION_HORIZONTAL, 0.05, 1.0, 0.01));
-    gtk_range_set_value(GTK_RANGE(st->opacity_scale), st->cfg.a);
+    gtk_range_set_value(GTK_RANGE(st->opacity_scale), cfg->a);
     gtk_scale_set_draw_value(st->opacity_scale, TRUE);
     g_signal_connect(st->opacity_scale, "value-changed", G_CALLBACK(on_scale_value), st);
     adw_preferences_group_add(style_group, labeled_row_widget("Opacity", GTK_WIDGET(st->opacity_scale)));
@@ -556,26 +1474,26 @@ static GtkWidget* build_preferences(AppState *st) {
     adw_preferences_page_add(page, outline_group);
 
     st->outline_switch = GTK_SWITCH(gtk_switch_new());
-    gtk_switch_set_active(st->outline_switch, st->cfg.show_outline);
+    gtk_switch_set_active(st->outline_switch, cfg->show_outline);
     g_signal_connect(st->outline_switch, "notify::active", G_CALLBACK(on_outline_toggled), st);
     adw_preferences_group_add(outline_group, labeled_row_widget("Enable Outline", GTK_WIDGET(st->outline_switch)));
 
     st->outline_color_button = GTK_COLOR_DIALOG_BUTTON(gtk_color_dialog_button_new(gtk_color_dialog_new()));
     {
-        GdkRGBA rgba = { st->cfg.or, st->cfg.og, st->cfg.ob, st->cfg.oa };
+        GdkRGBA rgba = { cfg->or, cfg->og, cfg->ob, cfg->oa };
         gtk_color_dialog_button_set_rgba(st->outline_color_button, &rgba);
     }
     g_signal_connect(st->outline_color_button, "notify::rgba", G_CALLBACK(on_outline_color_changed), st);
     adw_preferences_group_add(outline_group, labeled_row_widget("Outline Color", GTK_WIDGET(st->outline_color_button)));
 
     st->outline_thickness_scale = GTK_SCALE(gtk_scale_new_with_range(GTK_ORIENTATION_HORIZONTAL, 0.5, 10.0, 0.5));
-    gtk_range_set_value(GTK_RANGE(st->outline_thickness_scale), st->cfg.outline_thickness);
+    gtk_range_set_value(GTK_RANGE(st->outline_thickness_scale), cfg->outline_thickness);
     gtk_scale_set_draw_value(st->outline_thickness_scale, TRUE);
     g_signal_connect(st->outline_thickness_scale, "value-changed", G_CALLBACK(on_scale_value), st);
     adw_preferences_group_add(outline_group, labeled_row_widget("Outline Thickness", GTK_WIDGET(st->outline_thickness_scale)));
 
     st->outline_opacity_scale = GTK_SCALE(gtk_scale_new_with_range(GTK_ORIENTATION_HORIZONTAL, 0.0, 1.0, 0.01));
-    gtk_range_set_value(GTK_RANGE(st->outline_opacity_scale), st->cfg.outline_opacity);
+    gtk_range_set_value(GTK_RANGE(st->outline_opacity_scale), cfg->outline_opacity);
     gtk_scale_set_draw_value(st->outline_opacity_scale, TRUE);
     g_signal_connect(st->outline_opacity_scale, "value-changed", G_CALLBACK(on_scale_value), st);
     adw_preferences_group_add(outline_group, labeled_row_widget("Outline Opacity", GTK_WIDGET(st->outline_opacity_scale)));
@@ -586,13 +1504,13 @@ static GtkWidget* build_preferences(AppState *st) {
 
     GtkAdjustment *adj_x = gtk_adjustment_new(0.0, -4000.0, 4000.0, 1.0, 10.0, 0.0);
     st->posx_spin = GTK_SPIN_BUTTON(gtk_spin_button_new(adj_x, 1.0, 0));
-    gtk_spin_button_set_value(st->posx_spin, st->cfg.offset_x);
+    gtk_spin_button_set_value(st->posx_spin, cfg->offset_x);
     g_signal_connect(st->posx_spin, "value-changed", G_CALLBACK(on_position_changed), st);
     adw_preferences_group_add(position_group, labeled_row_widget("X Offset (px)", GTK_WIDGET(st->posx_spin)));
 
     GtkAdjustment *adj_y = gtk_adjustment_new(0.0, -4000.0, 4000.0, 1.0, 10.0, 0.0);
     st->posy_spin = GTK_SPIN_BUTTON(gtk_spin_button_new(adj_y, 1.0, 0));
-    gtk_spin_button_set_value(st->posy_spin, st->cfg.offset_y);
+    gtk_spin_button_set_value(st->posy_spin, cfg->offset_y);
     g_signal_connect(st->posy_spin, "value-changed", G_CALLBACK(on_position_changed), st);
     adw_preferences_group_add(position_group, labeled_row_widget("Y Offset (px)", GTK_WIDGET(st->posy_spin)));
 
@@ -646,35 +1564,40 @@ static GtkWidget* build_overlay(AppState *st) {
     g_object_unref(css);
 
     gtk_drawing_area_set_draw_func(st->drawing_area, (GtkDrawingAreaDrawFunc)draw_cb, st, NULL);
-    gtk_window_set_child(w, GTK_WIDGET(st->drawing_area));
+    g_signal_connect(st->drawing_area, "resize", G_CALLBACK(on_area_resize), st);
+
+    st->layer_fixed = GTK_FIXED(gtk_fixed_new());
+    gtk_widget_set_can_target(GTK_WIDGET(st->layer_fixed), FALSE);
+
+    st->layer_stack = GTK_OVERLAY(gtk_overlay_new());
+    gtk_widget_set_can_target(GTK_WIDGET(st->layer_stack), FALSE);
+    gtk_overlay_set_child(st->layer_stack, GTK_WIDGET(st->drawing_area));
+    gtk_overlay_add_overlay(st->layer_stack, GTK_WIDGET(st->layer_fixed));
+    gtk_window_set_child(w, GTK_WIDGET(st->layer_stack));
 
     g_signal_connect(w, "realize", G_CALLBACK(on_realize_configure_surface), st);
+    g_signal_connect(w, "notify::scale-factor", G_CALLBACK(on_scale_factor_changed), st);
 
     return GTK_WIDGET(w);
 }
 
 static void apply_default_config(AppState *st) {
-    st->cfg.r = 0.15; st->cfg.g = 0.85; st->cfg.b = 0.35; st->cfg.a = 0.95;
-    st->cfg.thickness = 2.0;
-    st->cfg.size = 40.0;
-    st->cfg.gap = 8.0;
-    st->cfg.style = STYLE_CROSS_DOT;
-
-    st->cfg.show_outline = TRUE;
-    st->cfg.outline_thickness = 1.5;
-    st->cfg.or = 0.0; st->cfg.og = 0.0; st->cfg.ob = 0.0; st->cfg.oa = 0.9;
-    st->cfg.outline_opacity = 1.0;
-
-    st->cfg.offset_x = 0.0;
-    st->cfg.offset_y = 0.0;
-
+    st->layers = g_ptr_array_new_with_free_func((GDestroyNotify)crosshair_layer_free);
+    st->active_layer = 0;
     st->overlay_visible = TRUE;
 }
 
 static void on_quit(GSimpleAction *action, GVariant *param, gpointer user_data) {
     (void)action; (void)param;
     AppState *st = user_data;
-    save_config(st);
+    if (!st->startup_pending) {
+        save_config(st);
+        if (st->snapshot_save_id) {
+            g_source_remove(st->snapshot_save_id);
+            st->snapshot_save_id = 0;
+        }
+        save_snapshot(st, TRUE);
+    }
     g_application_quit(G_APPLICATION(st->app));
 }
 
@@ -686,36 +1609,207 @@ static void on_toggle_overlay(GSimpleAction *action, GVariant *param, gpointer u
     set_click_through_and_transparent(GTK_WIDGET(st->overlay));
 }
 
+// Pushes the active layer's values into the preferences without their
+// handlers writing the config back.
+static void sync_widgets_from_config(AppState *st, ConfigChange changes) {
+    if (!st->prefs) return;
+    const CrosshairConfig *cfg = &active_layer(st)->cfg;
+    st->syncing_widgets = TRUE;
+    if (changes & CFG_CHANGED_VISIBILITY)
+        gtk_switch_set_active(st->visible_switch, cfg->visible);
+    if (changes & CFG_CHANGED_GEOMETRY) {
+        gtk_drop_down_set_selected(st->style_dropdown, cfg->style);
+        gtk_range_set_value(GTK_RANGE(st->thickness_scale), cfg->thickness);
+        gtk_range_set_value(GTK_RANGE(st->size_scale), cfg->size);
+        gtk_range_set_value(GTK_RANGE(st->gap_scale), cfg->gap);
+        gtk_switch_set_active(st->outline_switch, cfg->show_outline);
+        gtk_range_set_value(GTK_RANGE(st->outline_thickness_scale), cfg->outline_thickness);
+    }
+    if (changes & CFG_CHANGED_COLOR) {
+        GdkRGBA rgba = { cfg->r, cfg->g, cfg->b, cfg->a };
+        gtk_color_dialog_button_set_rgba(st->color_button, &rgba);
+        GdkRGBA orgba = { cfg->or, cfg->og, cfg->ob, cfg->oa };
+        gtk_color_dialog_button_set_rgba(st->outline_color_button, &orgba);
+        gtk_range_set_value(GTK_RANGE(st->opacity_scale), cfg->a);
+        gtk_range_set_value(GTK_RANGE(st->outline_opacity_scale), cfg->outline_opacity);
+    }
+    if (changes & CFG_CHANGED_OFFSET) {
+        gtk_spin_button_set_value(st->posx_spin, cfg->offset_x);
+        gtk_spin_button_set_value(st->posy_spin, cfg->offset_y);
+    }
+    st->syncing_widgets = FALSE;
+}
+
+static void reload_config(AppState *st) {
+    char *path = hc_get_config_path();
+    char *data = NULL;
+    gsize len = 0;
+    gboolean ok = g_file_get_contents(path, &data, &len, NULL);
+    g_free(path);
+    // A missing file is usually an editor mid-save; keep what we have.
+    if (!ok) return;
+
+    // Our own save_config writes land here too and hash to what we wrote.
+    char *hash = hc_config_checksum(data, len);
+    if (g_strcmp0(hash, st->config_hash) == 0) {
+        g_free(hash);
+        g_free(data);
+        return;
+    }
+
+    GArray *cfgs = parse_config_data(data, len);
+    g_free(data);
+    // Leave the hash alone so the completed write is still picked up.
+    if (!cfgs) {
+        g_free(hash);
+        return;
+    }
+    g_free(st->config_hash);
+    st->config_hash = hash;
+    schedule_snapshot_save(st);
+
+    // Each layer is diffed on its own and only its drawing area is touched.
+    ConfigChange active_changes = CFG_CHANGED_NONE;
+    guint common = MIN(cfgs->len, st->layers->len);
+    for (guint i = 0; i < common; i++) {
+        CrosshairLayer *layer = g_ptr_array_index(st->layers, i);
+        const CrosshairConfig *next = &g_array_index(cfgs, CrosshairConfig, i);
+        ConfigChange changes = crosshair_config_diff(&layer->cfg, next);
+        if (changes == CFG_CHANGED_NONE) continue;
+
+        gboolean visible_changed = (changes & CFG_CHANGED_VISIBILITY) != 0;
+        layer->cfg = *next;
+        if (visible_changed)
+            set_layer_visible(layer, next->visible);
+        update_layer(layer, changes);
+        if (i == st->active_layer)
+            active_changes = changes;
+    }
+
+    gboolean count_changed = cfgs->len != st->layers->len;
+    if (st->layers->len > cfgs->len)
+        g_ptr_array_remove_range(st->layers, cfgs->len, st->layers->len - cfgs->len);
+    for (guint i = st->layers->len; i < cfgs->len; i++)
+        g_ptr_array_add(st->layers, crosshair_layer_new(st, &g_array_index(cfgs, CrosshairConfig, i)));
+    g_array_unref(cfgs);
+
+    if (count_changed) {
+        if (st->active_layer >= st->layers->len) {
+            st->active_layer = st->layers->len - 1;
+            active_changes = CFG_CHANGED_ALL;
+        }
+        if (st->prefs) {
+            refresh_layer_list(st);
+            gtk_widget_set_sensitive(GTK_WIDGET(st->remove_layer_button), st->active_layer > 0);
+        }
+        schedule_snapshot_save(st);
+        release_snapshot_if_ready(st);
+    }
+    if (active_changes != CFG_CHANGED_NONE)
+        sync_widgets_from_config(st, active_changes);
+}
+
+static gboolean reload_config_cb(gpointer user_data) {
+    AppState *st = user_data;
+    st->reload_id = 0;
+    reload_config(st);
+    return G_SOURCE_REMOVE;
+}
+
+static void on_config_file_changed(GFileMonitor *monitor, GFile *file, GFile *other, GFileMonitorEvent event, AppState *st) {
+    (void)monitor; (void)file; (void)other;
+    if (event == G_FILE_MONITOR_EVENT_ATTRIBUTE_CHANGED ||
+        event == G_FILE_MONITOR_EVENT_PRE_UNMOUNT ||
+        event == G_FILE_MONITOR_EVENT_UNMOUNTED)
+        return;
+    // Collapse bursts of writes (editors, dotfile managers) into one reload.
+    if (st->reload_id)
+        g_source_remove(st->reload_id);
+    st->reload_id = g_timeout_add(200, reload_config_cb, st);
+}
+
+static void watch_config(AppState *st) {
+    char *path = hc_get_config_path();
+    GFile *file = g_file_new_for_path(path);
+    GError *err = NULL;
+    st->config_monitor = g_file_monitor_file(file, G_FILE_MONITOR_NONE, NULL, &err);
+    if (st->config_monitor) {
+        g_signal_connect(st->config_monitor, "changed", G_CALLBACK(on_config_file_changed), st);
+    } else {
+        g_warning("cannot watch %s: %s", path, err->message);
+        g_clear_error(&err);
+    }
+    g_object_unref(file);
+    g_free(path);
+}
+
+static GdkMonitor* first_monitor(void) {
+    GListModel *mons = gdk_display_get_monitors(gdk_display_get_default());
+    if (g_list_model_get_n_items(mons) == 0) return NULL;
+    return GDK_MONITOR(g_list_model_get_item(mons, 0));
+}
+
+static void finish_startup(AppState *st) {
+    if (st->finish_startup_id) {
+        g_source_remove(st->finish_startup_id);
+        st->finish_startup_id = 0;
+    }
+    GArray *cfgs = load_config(st);
+    for (guint i = 0; i < cfgs->len; i++)
+        g_ptr_array_add(st->layers, crosshair_layer_new(st, &g_array_index(cfgs, CrosshairConfig, i)));
+    g_array_unref(cfgs);
+
+    GtkWidget *prefs = build_preferences(st);
+    (void)prefs;
+
+    set_overlay_monitor(st, gtk_drop_down_get_selected(st->monitor_dropdown));
+    if (!st->using_layer_shell)
+        update_default_size_to_monitor(st);
+
+    gtk_window_present(GTK_WINDOW(st->prefs));
+    watch_config(st);
+
+    st->startup_pending = FALSE;
+    release_snapshot_if_ready(st);
+    queue_redraw(st);
+}
+
 static void app_activate(GApplication *app, gpointer user_data) {
     (void)user_data;
     AppState *st = g_new0(AppState, 1);
     st->app = ADW_APPLICATION(app);
     apply_default_config(st);
-    load_config(st);
 
     GtkWidget *ov = build_overlay(st);
     st->overlay = GTK_WINDOW(ov);
 
-    GtkWidget *prefs = build_preferences(st);
-    (void)prefs;
-
-    set_overlay_monitor(st, gtk_drop_down_get_selected(st->monitor_dropdown));
+    // Pin the overlay to the monitor the preferences will select by default so
+    // the cached frame lands where it was rendered.
+    GdkMonitor *mon = first_monitor();
+    if (mon && st->using_layer_shell)
+        gtk_layer_set_monitor(st->overlay, mon);
     if (!st->using_layer_shell)
         update_default_size_to_monitor(st);
-
-    gtk_widget_set_visible(ov, TRUE);
-    set_click_through_and_transparent(ov);
-
-    gtk_window_present(GTK_WINDOW(st->prefs));
+    st->snapshot = load_snapshot(mon);
+    g_clear_object(&mon);
 
     const GActionEntry entries[] = {
         { .name = "quit", .activate = on_quit },
         { .name = "toggle-overlay", .activate = on_toggle_overlay },
     };
     g_action_map_add_action_entries(G_ACTION_MAP(app), entries, G_N_ELEMENTS(entries), st);
+
+    st->startup_pending = st->snapshot != NULL;
+
+    gtk_widget_set_visible(ov, TRUE);
+    set_click_through_and_transparent(ov);
+
+    if (!st->startup_pending)
+        finish_startup(st);
 }
 
 int main(int argc, char **argv) {
+    hc_start_time = g_get_monotonic_time();
     g_set_prgname("hyprcrosshair");
     adw_init();
 